@@ -9,6 +9,13 @@
 #include <unordered_set>
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace fs = std::filesystem;
 
@@ -467,8 +474,183 @@ std::cout << "Merge complete! Commit: " << newHash << "\n";
 
 
 }
+// ---------------- Diff ----------------
+
+// Read-only view of a file mapped into memory. Pages are backed by the file
+// itself, so the kernel can drop them again and memory stays bounded no
+// matter how large the file is.
+struct MappedFile {
+    const char* data = nullptr;
+    size_t size = 0;
+    bool ok = false;
+
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            size = static_cast<size_t>(st.st_size);
+            if (size == 0) {
+                ok = true;
+            } else {
+                void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    ::madvise(p, size, MADV_SEQUENTIAL);
+                    data = static_cast<const char*>(p);
+                    ok = true;
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data) ::munmap(const_cast<char*>(data), size);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+// Length of the common prefix of a and b (both at least n bytes long).
+// Whole blocks are compared with memcmp, which libc vectorizes, so identical
+// regions are skipped at memory bandwidth; only the first differing block is
+// scanned byte by byte.
+size_t commonPrefixLength(const char* a, const char* b, size_t n) {
+    const size_t blockSize = 64 * 1024;
+    size_t pos = 0;
+    while (pos < n) {
+        size_t len = std::min(blockSize, n - pos);
+        if (std::memcmp(a + pos, b + pos, len) != 0) {
+            while (a[pos] == b[pos]) ++pos;
+            return pos;
+        }
+        pos += len;
+    }
+    return n;
+}
+
+// Same heuristic as git: a NUL byte near the start means binary content.
+bool looksBinary(const MappedFile& file) {
+    size_t len = std::min<size_t>(file.size, 8000);
+    return len > 0 && std::memchr(file.data, '\0', len) != nullptr;
+}
+
+void diffBinary(const MappedFile& a, const MappedFile& b) {
+    // Differing runs separated by fewer equal bytes than this are reported
+    // as one range, so noisy regions don't print a range per byte.
+    const size_t mergeGap = 16;
+    size_t common = std::min(a.size, b.size);
+    size_t pos = 0;
+    bool differenceFound = false;
+
+    while (pos < common) {
+        pos += commonPrefixLength(a.data + pos, b.data + pos, common - pos);
+        if (pos >= common) break;
+
+        size_t start = pos;
+        size_t end = pos + 1;
+        size_t equalRun = 0;
+        for (size_t i = end; i < common && equalRun < mergeGap; ++i) {
+            if (a.data[i] == b.data[i]) {
+                ++equalRun;
+            } else {
+                equalRun = 0;
+                end = i + 1;
+            }
+        }
+
+        differenceFound = true;
+        std::cout << "Bytes " << start << "-" << end - 1 << " differ\n";
+        pos = end;
+    }
+
+    if (a.size > common) {
+        differenceFound = true;
+        std::cout << "Bytes " << common << "-" << a.size - 1 << " only in A\n";
+    } else if (b.size > common) {
+        differenceFound = true;
+        std::cout << "Bytes " << common << "-" << b.size - 1 << " only in B\n";
+    }
+
+    if (!differenceFound) {
+        std::cout << "No differences found.\n";
+    } else {
+        std::cout << "Binary files differ (A: " << a.size << " bytes, B: " << b.size << " bytes)\n";
+    }
+}
+
+void diffText(const MappedFile& a, const MappedFile& b) {
+    const char* endA = a.data + a.size;
+    const char* endB = b.data + b.size;
+    const char* posA = a.data;
+    const char* posB = b.data;
+    size_t lineNum = 1;
+    bool differenceFound = false;
+
+    // Returns the line starting at pos (without '\n') and advances pos past it.
+    auto nextLine = [](const char*& pos, const char* end) {
+        const char* nl = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        const char* lineEnd = nl ? nl : end;
+        std::string_view line(pos, lineEnd - pos);
+        pos = nl ? nl + 1 : end;
+        return line;
+    };
+
+    while (posA < endA && posB < endB) {
+        // Both positions are at line starts: skip every whole line of the
+        // identical run in one go instead of comparing line by line.
+        size_t n = std::min<size_t>(endA - posA, endB - posB);
+        size_t same = commonPrefixLength(posA, posB, n);
+        const char* lastNl = nullptr;
+        for (const char* p = posA + same; p > posA; --p) {
+            if (p[-1] == '\n') {
+                lastNl = p - 1;
+                break;
+            }
+        }
+        if (lastNl) {
+            size_t skipped = lastNl + 1 - posA;
+            lineNum += std::count(posA, lastNl + 1, '\n');
+            posA += skipped;
+            posB += skipped;
+            if (posA >= endA || posB >= endB) break;
+        }
+
+        std::string_view lineA = nextLine(posA, endA);
+        std::string_view lineB = nextLine(posB, endB);
+        if (lineA != lineB) {
+            differenceFound = true;
+            std::cout << "Line " << lineNum << ":\n";
+            std::cout << "- A: " << lineA << "\n";
+            std::cout << "+ B: " << lineB << "\n";
+        }
+        ++lineNum;
+    }
+
+    // Handle extra lines
+    while (posA < endA) {
+        differenceFound = true;
+        std::cout << "Line " << lineNum << ":\n";
+        std::cout << "- A: " << nextLine(posA, endA) << "\n";
+        ++lineNum;
+    }
+
+    while (posB < endB) {
+        differenceFound = true;
+        std::cout << "Line " << lineNum << ":\n";
+        std::cout << "+ B: " << nextLine(posB, endB) << "\n";
+        ++lineNum;
+    }
+
+    if (!differenceFound) {
+        std::cout << "No differences found.\n";
+    }
+}
+
 void diffFile(const std::string& filename, const std::string& commitA, const std::string& commitB) {
-    auto getFileContentFromCommit = [](const std::string& commitHash, const std::string& filename) {
+    auto getBlobPathFromCommit = [](const std::string& commitHash, const std::string& filename) {
         std::ifstream commitFile(".minigit/commits/" + commitHash);
         if (!commitFile) return std::string{};
 
@@ -492,72 +674,47 @@ void diffFile(const std::string& filename, const std::string& commitA, const std
         }
 
         if (hash.empty()) return std::string{};
-
-        std::ifstream blob(".minigit/objects/" + hash);
-        if (!blob) return std::string{};
-
-        return std::string((std::istreambuf_iterator<char>(blob)), std::istreambuf_iterator<char>());
+        return ".minigit/objects/" + hash;
     };
 
-    std::string contentA, contentB;
+    std::string pathA, pathB;
 
     if (commitA.empty()) {
         // Load from working directory
-        std::ifstream file(filename);
-        if (!file) {
-            std::cerr << "File not found in working directory.\n";
-            return;
-        }
-        contentA = std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        pathA = filename;
     } else {
-        contentA = getFileContentFromCommit(commitA, filename);
-        if (contentA.empty()) {
+        pathA = getBlobPathFromCommit(commitA, filename);
+        if (pathA.empty()) {
             std::cerr << "File not found in commit " << commitA << "\n";
             return;
         }
     }
 
-    contentB = getFileContentFromCommit(commitB, filename);
-    if (contentB.empty()) {
+    pathB = getBlobPathFromCommit(commitB, filename);
+    if (pathB.empty()) {
         std::cerr << "File not found in commit " << commitB << "\n";
         return;
     }
 
-    // Compare line by line
-    std::istringstream streamA(contentA);
-    std::istringstream streamB(contentB);
-    std::string lineA, lineB;
-    int lineNum = 1;
-    bool differenceFound = false;
-
-    while (std::getline(streamA, lineA) && std::getline(streamB, lineB)) {
-        if (lineA != lineB) {
-            differenceFound = true;
-            std::cout << "Line " << lineNum << ":\n";
-            std::cout << "- A: " << lineA << "\n";
-            std::cout << "+ B: " << lineB << "\n";
+    MappedFile fileA(pathA);
+    if (!fileA.ok) {
+        if (commitA.empty()) {
+            std::cerr << "File not found in working directory.\n";
+        } else {
+            std::cerr << "File not found in commit " << commitA << "\n";
         }
-        ++lineNum;
-    }
-
-    // Handle extra lines
-    while (std::getline(streamA, lineA)) {
-        differenceFound = true;
-        std::cout << "Line " << lineNum << ":\n";
-        std::cout << "- A: " << lineA << "\n";
-        ++lineNum;
+        return;
     }
 
-    while (std::getline(streamB, lineB)) {
-        differenceFound = true;
-        std::cout << "Line " << lineNum << ":\n";
-        std::cout << "+ B: " << lineB << "\n";
-        ++lineNum;
+    MappedFile fileB(pathB);
+    if (!fileB.ok) {
+        std::cerr << "File not found in commit " << commitB << "\n";
+        return;
     }
 
-    if (!differenceFound) {
-        std::cout << "No differences found.\n";
+    if (looksBinary(fileA) || looksBinary(fileB)) {
+        diffBinary(fileA, fileB);
+    } else {
+        diffText(fileA, fileB);
     }
 }
-
-